@@ -93,7 +93,7 @@ public:
    {
       return opened;
    }
-   gzstreambuf* open( const char* name, int open_mode );
+   gzstreambuf* open( const char* name, int open_mode, int level = 0 );
    gzstreambuf* close();
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
@@ -121,12 +121,12 @@ public:
    {
       init(&buf);
    }
-   gzstreambase( const char* _name, int _open_mode );
+   gzstreambase( const char* _name, int _open_mode, int _level = 0 );
    ~gzstreambase();
 
    //------------------------------------
 
-   void open( const char* _name, int _open_mode );
+   void open( const char* _name, int _open_mode, int _level = 0 );
    void close();
    gzstreambuf* rdbuf()
    {
@@ -191,8 +191,9 @@ public:
    {}
    explicit
    ogzstream( const char* _name,
-              int         _open_mode = std::ios::out )
-      : gzstreambase( _name, _open_mode )
+              int         _open_mode = std::ios::out,
+              int         _level = 0 )
+      : gzstreambase( _name, _open_mode, _level )
       , std::ostream( &buf)
    {}
 
@@ -203,9 +204,10 @@ public:
       return gzstreambase::rdbuf();
    }
    void open( const char*  _name,
-              int          _open_mode = std::ios::out )
+              int          _open_mode = std::ios::out,
+              int          _level = 0 )
    {
-      gzstreambase::open( _name, _open_mode );
+      gzstreambase::open( _name, _open_mode, _level );
    }
 };
 